@@ -1066,6 +1066,24 @@ connect_better_edge_p (const_edge e, bool src_index_p, int best_len,
   return is_better_edge;
 }
 
+/* Return true if the trace ending in SRC should not be connected to the
+   trace starting in DEST because exactly one of them is probably never
+   executed.  Leaving such traces apart lets connect_traces emit the cold
+   traces after all the executed ones instead of in between them.  */
+
+static bool
+cold_connection_p (const_basic_block src, const_basic_block dest)
+{
+  if (probably_never_executed_bb_p (cfun, src)
+      == probably_never_executed_bb_p (cfun, dest))
+    return false;
+
+  if (dump_file && (dump_flags & TDF_DETAILS))
+    fprintf (dump_file, "Not connecting %d %d: only one side is probably "
+	     "never executed\n", src->index, dest->index);
+  return true;
+}
+
 /* Connect traces in array TRACES, N_TRACES is the count of traces.  */
 
 static void
@@ -1138,6 +1156,7 @@ connect_traces (int n_traces, struct trace *traces)
 		  && bbd[si].end_of_trace >= 0
 		  && !connected[bbd[si].end_of_trace]
 		  && (BB_PARTITION (e->src) == current_partition)
+		  && (for_size || !cold_connection_p (e->src, e->dest))
 		  && connect_better_edge_p (e, true, best_len, best, traces))
 		{
 		  best = e;
@@ -1181,6 +1200,7 @@ connect_traces (int n_traces, struct trace *traces)
 		  && bbd[di].start_of_trace >= 0
 		  && !connected[bbd[di].start_of_trace]
 		  && (BB_PARTITION (e->dest) == current_partition)
+		  && (for_size || !cold_connection_p (e->src, e->dest))
 		  && connect_better_edge_p (e, false, best_len, best, traces))
 		{
 		  best = e;
@@ -1249,6 +1269,7 @@ connect_traces (int n_traces, struct trace *traces)
 		if (e->dest != EXIT_BLOCK_PTR_FOR_FN (cfun)
 		    && (e->flags & EDGE_CAN_FALLTHRU)
 		    && !(e->flags & EDGE_COMPLEX)
+		    && !cold_connection_p (traces[t].last, e->dest)
 		    && (!best || e->probability > best->probability))
 		  {
 		    edge_iterator ei;
@@ -1450,15 +1450,17 @@ bitmap_and_into (bitmap a, const_bitmap b)
 	  /* Matching elts, generate A &= B.  */
 	  unsigned ix;
 	  BITMAP_WORD ior = 0;
+	  BITMAP_WORD cleared = 0;
 
 	  for (ix = 0; ix < BITMAP_ELEMENT_WORDS; ix++)
 	    {
 	      BITMAP_WORD r = a_elt->bits[ix] & b_elt->bits[ix];
-	      if (a_elt->bits[ix] != r)
-		changed = true;
+	      cleared |= a_elt->bits[ix] ^ r;
 	      a_elt->bits[ix] = r;
 	      ior |= r;
 	    }
+	  if (cleared)
+	    changed = true;
 	  next = a_elt->next;
 	  if (!ior)
 	    bitmap_list_unlink_element (a, a_elt);
@@ -1491,13 +1493,14 @@ bitmap_elt_copy (bitmap dst, bitmap_element *dst_elt, bitmap_element *dst_prev,
   if (!changed && dst_elt && dst_elt->indx == src_elt->indx)
     {
       unsigned ix;
+      BITMAP_WORD diff = 0;
 
       for (ix = 0; ix < BITMAP_ELEMENT_WORDS; ix++)
-	if (src_elt->bits[ix] != dst_elt->bits[ix])
-	  {
-	    dst_elt->bits[ix] = src_elt->bits[ix];
-	    changed = true;
-	  }
+	{
+	  diff |= src_elt->bits[ix] ^ dst_elt->bits[ix];
+	  dst_elt->bits[ix] = src_elt->bits[ix];
+	}
+      changed = diff != 0;
     }
   else
     {
@@ -1558,17 +1561,17 @@ bitmap_and_compl (bitmap dst, const_bitmap a, const_bitmap b)
 
 	  if (!changed && dst_elt && dst_elt->indx == a_elt->indx)
 	    {
+	      BITMAP_WORD diff = 0;
+
 	      for (ix = 0; ix < BITMAP_ELEMENT_WORDS; ix++)
 		{
 		  BITMAP_WORD r = a_elt->bits[ix] & ~b_elt->bits[ix];
 
-		  if (dst_elt->bits[ix] != r)
-		    {
-		      changed = true;
-		      dst_elt->bits[ix] = r;
-		    }
+		  diff |= dst_elt->bits[ix] ^ r;
+		  dst_elt->bits[ix] = r;
 		  ior |= r;
 		}
+	      changed = diff != 0;
 	    }
 	  else
 	    {
@@ -2016,15 +2019,15 @@ bitmap_elt_ior (bitmap dst, bitmap_element *dst_elt, bitmap_element *dst_prev,
 
       if (!changed && dst_elt && dst_elt->indx == a_elt->indx)
 	{
+	  BITMAP_WORD diff = 0;
+
 	  for (ix = 0; ix < BITMAP_ELEMENT_WORDS; ix++)
 	    {
 	      BITMAP_WORD r = a_elt->bits[ix] | b_elt->bits[ix];
-	      if (r != dst_elt->bits[ix])
-		{
-		  dst_elt->bits[ix] = r;
-		  changed = true;
-		}
+	      diff |= r ^ dst_elt->bits[ix];
+	      dst_elt->bits[ix] = r;
 	    }
+	  changed = diff != 0;
 	}
       else
 	{
@@ -2960,6 +2963,40 @@ test_copying ()
   ASSERT_FALSE (bitmap_bit_p (dst, 70));
 }
 
+/* Verify that the set operations report whether the destination
+   changed.  */
+
+static void
+test_change_reporting ()
+{
+  bitmap a = bitmap_gc_alloc ();
+  bitmap b = bitmap_gc_alloc ();
+  bitmap empty = bitmap_gc_alloc ();
+  bitmap dst = bitmap_gc_alloc ();
+  bitmap_set_range (a, 0, 10);
+  bitmap_set_range (b, 5, 10);
+
+  ASSERT_TRUE (bitmap_ior_into (a, b));
+  ASSERT_FALSE (bitmap_ior_into (a, b));
+  ASSERT_EQ (15, bitmap_count_bits (a));
+
+  ASSERT_TRUE (bitmap_ior (dst, a, b));
+  ASSERT_FALSE (bitmap_ior (dst, a, b));
+  ASSERT_TRUE (bitmap_equal_p (dst, a));
+
+  ASSERT_TRUE (bitmap_and_compl (dst, a, b));
+  ASSERT_FALSE (bitmap_and_compl (dst, a, b));
+  ASSERT_EQ (5, bitmap_count_bits (dst));
+
+  ASSERT_TRUE (bitmap_ior (dst, a, empty));
+  ASSERT_FALSE (bitmap_ior (dst, a, empty));
+  ASSERT_TRUE (bitmap_equal_p (dst, a));
+
+  ASSERT_TRUE (bitmap_and_into (a, b));
+  ASSERT_FALSE (bitmap_and_into (a, b));
+  ASSERT_TRUE (bitmap_equal_p (a, b));
+}
+
 /* Verify bitmap_single_bit_set_p.  */
 
 static void
@@ -3018,6 +3055,7 @@ bitmap_cc_tests ()
   test_set_range ();
   test_clear_bit_in_middle ();
   test_copying ();
+  test_change_reporting ();
   test_bitmap_single_bit_set_p ();
   /* Test 2, 4 and 8 bit aligned chunks.  */
   test_aligned_chunk (2);
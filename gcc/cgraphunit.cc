@@ -2046,6 +2046,18 @@ expand_all_functions (void)
 	break;
       prev_gc_candidates = gc_candidates;
       gc_candidates = 0;
+
+      /* Only functions not expanded yet need to be revisited: the deferred
+	 gc candidates and candidates whose gc_candidate flag was cleared
+	 after this pass visited them (e.g. simd clones used by a caller
+	 expanded later in the pass).  Compact ORDER to them (keeping their
+	 relative order) so that the remaining passes do not rescan every
+	 function of a large unit.  */
+      int candidate_pos = 0;
+      for (i = 0; i < new_order_pos; i++)
+	if (order[i]->process)
+	  order[candidate_pos++] = order[i];
+      new_order_pos = candidate_pos;
     }
 
   /* Free any unused gc_candidate functions.  */
@@ -167,20 +167,15 @@ linux_gt_pch_get_address (size_t size, int fd)
   return addr;
 }
 
-/* Map SIZE bytes of FD+OFFSET at BASE.  Return 1 if we succeeded at
-   mapping the data at BASE, -1 if we couldn't.
+/* Map SIZE bytes of FD+OFFSET at BASE, or wherever the kernel places
+   them, updating BASE.  Return 1 if we succeeded at mapping the data,
+   -1 if we couldn't.
 
-   It's not possibly to reliably mmap a file using MAP_PRIVATE to
-   a specific START address on either hpux or linux.  First we see
-   if mmap with MAP_PRIVATE works.  If it does, we are off to the
-   races.  If it doesn't, we try an anonymous private mmap since the
-   kernel is more likely to honor the BASE address in anonymous maps.
-   We then copy the data to the anonymous private map.  This assumes
-   of course that we don't need to change the data in the PCH file
-   after it is created.
-
-   This approach obviously causes a performance penalty but there is
-   little else we can do given the current PCH implementation.  */
+   mmap with MAP_PRIVATE and no MAP_FIXED does not reliably honor BASE,
+   so a mapping of the file at a different address is accepted as well;
+   gt_pch_restore then relocates the PCH data to the new BASE.  Only if
+   the file cannot be mapped at all do we read it into an anonymous
+   private mapping, preferably at the requested BASE.  */
 
 static int
 linux_gt_pch_use_address (void *&base, size_t size, int fd, size_t offset)
@@ -199,8 +194,16 @@ linux_gt_pch_use_address (void *&base, size_t size, int fd, size_t offset)
   if (addr == base)
     return 1;
 
+  /* The file could be mapped, just not at the desired location.  Keep
+     that mapping and let gt_pch_restore relocate it instead of reading
+     the whole file into anonymous memory: only the pages that contain
+     pointers are then copied on write, the rest stays shared through
+     the page cache with other compilers using the same PCH.  */
   if (addr != (void *) MAP_FAILED)
-    munmap (addr, size);
+    {
+      base = addr;
+      return 1;
+    }
 
   /* Try to make an anonymous private mmap at the desired location.  */
   addr = mmap (base, size, PROT_READ | PROT_WRITE,
@@ -2934,6 +2934,12 @@ ix86_option_override_internal (bool main_args_p,
   if (!TARGET_SCHEDULE)
     opts->x_flag_schedule_insns_after_reload = opts->x_flag_schedule_insns = 0;
 
+  /* The first scheduling pass is off by default because it tends to
+     increase register pressure.  When it is enabled explicitly, make it
+     register pressure aware unless told otherwise.  */
+  if (opts->x_flag_schedule_insns)
+    SET_OPTION_IF_UNSET (opts, opts_set, flag_sched_pressure, 1);
+
   SET_OPTION_IF_UNSET (opts, opts_set, param_simultaneous_prefetches,
 		       ix86_tune_cost->simultaneous_prefetches);
   SET_OPTION_IF_UNSET (opts, opts_set, param_l1_cache_line_size,
@@ -175,6 +175,7 @@ const kv_pair<optgroup_flags_t> optgroup_options[] =
   {"inline", OPTGROUP_INLINE},
   {"omp", OPTGROUP_OMP},
   {"vec", OPTGROUP_VEC},
+  {"thread", OPTGROUP_THREAD},
   {"optall", OPTGROUP_ALL},
   {NULL, OPTGROUP_NONE}
 };
@@ -267,11 +267,15 @@ enum optgroup_flag
   /* Vectorization passes */
   OPTGROUP_VEC = (1 << 5),
 
+  /* Jump threading passes */
+  OPTGROUP_THREAD = (1 << 6),
+
   /* All other passes */
-  OPTGROUP_OTHER = (1 << 6),
+  OPTGROUP_OTHER = (1 << 7),
 
   OPTGROUP_ALL = (OPTGROUP_IPA | OPTGROUP_LOOP | OPTGROUP_INLINE
-		  | OPTGROUP_OMP | OPTGROUP_VEC | OPTGROUP_OTHER)
+		  | OPTGROUP_OMP | OPTGROUP_VEC | OPTGROUP_THREAD
+		  | OPTGROUP_OTHER)
 };
 
 typedef enum optgroup_flag optgroup_flags_t;
@@ -1004,8 +1004,9 @@ mmap_gt_pch_get_address (size_t size, int fd)
 }
 
 /* Default version of HOST_HOOKS_GT_PCH_USE_ADDRESS when mmap is present.
-   Map SIZE bytes of FD+OFFSET at BASE.  Return 1 if we succeeded at
-   mapping the data at BASE, -1 if we couldn't.
+   Map SIZE bytes of FD+OFFSET at BASE, or wherever the kernel places
+   them, updating BASE.  Return 1 if we succeeded at mapping the data,
+   -1 if we couldn't.
 
    This version assumes that the kernel honors the START operand of mmap
    even without MAP_FIXED if START through START+SIZE are not currently
@@ -1025,7 +1026,12 @@ mmap_gt_pch_use_address (void *&base, size_t size, int fd, size_t offset)
   addr = mmap ((caddr_t) base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
 	       fd, offset);
 
-  return addr == base ? 1 : -1;
+  if (addr == (void *) MAP_FAILED)
+    return -1;
+
+  /* If the file was mapped elsewhere, gt_pch_restore relocates it.  */
+  base = addr;
+  return 1;
 }
 #endif /* HAVE_MMAP_FILE */
 
@@ -398,6 +398,14 @@ static struct ggc_globals
   /* Total amount of memory mapped.  */
   size_t bytes_mapped;
 
+  /* Number of collections performed so far.  */
+  unsigned long collections;
+
+  /* Sum over all collections of the bytes found live, i.e. marked again,
+     and of the bytes reclaimed.  */
+  unsigned long long total_live_after_gc;
+  unsigned long long total_reclaimed;
+
   /* Bit N set if any allocations have been done at context depth N.  */
   unsigned long context_depth_allocations;
 
@@ -1883,15 +1891,12 @@ ggc_recalculate_in_use_p (page_entry *p)
 		 sizeof (*p->in_use_p));
        ++i)
     {
-      unsigned long j;
-
       /* Something is in use if it is marked, or if it was in use in a
 	 context further down the context stack.  */
       p->in_use_p[i] |= save_in_use_p (p)[i];
 
       /* Decrement the free object count for every object allocated.  */
-      for (j = p->in_use_p[i]; j; j >>= 1)
-	p->num_free_objects -= (j & 1);
+      p->num_free_objects -= popcount_hwi (p->in_use_p[i]);
     }
 
   gcc_assert (p->num_free_objects < num_objects);
@@ -2268,6 +2273,11 @@ ggc_collect (enum ggc_collect mode)
   in_gc = false;
   G.allocated_last_gc = G.allocated;
 
+  G.collections++;
+  G.total_live_after_gc += G.allocated;
+  if (allocated > G.allocated)
+    G.total_reclaimed += allocated - G.allocated;
+
   invoke_plugin_callbacks (PLUGIN_GGC_END, NULL);
 
   timevar_pop (TV_GC);
@@ -2374,6 +2384,15 @@ ggc_print_statistics (void)
 	   SIZE_AMOUNT (G.allocated),
 	   SIZE_AMOUNT (total_overhead));
 
+  /* Memory that survives a collection has to be marked again by every
+     later one, so a high live to reclaimed ratio means most of the
+     collection time was spent on long-lived data.  */
+  fprintf (stderr, "\nCollections: %lu, live after collection: " PRsa (0)
+	   ", reclaimed: " PRsa (0) "\n",
+	   G.collections,
+	   SIZE_AMOUNT (G.total_live_after_gc),
+	   SIZE_AMOUNT (G.total_reclaimed));
+
   if (GATHER_STATISTICS)
     {
       fprintf (stderr, "\nTotal allocations and overheads during "
@@ -963,6 +963,7 @@ public:
 private:
   void update_data_info (unsigned, unsigned, vec<data_reference_p>, vec<ddr_p>);
   bool valid_data_dependences (unsigned, unsigned, vec<ddr_p>);
+  HOST_WIDE_INT max_data_footprint (unsigned, vec<data_reference_p>);
   void interchange_loops (loop_cand &, loop_cand &);
   void map_inductions_to_loop (loop_cand &, loop_cand &);
   void move_code_to_inner_loop (class loop *, class loop *, basic_block *);
@@ -1599,6 +1600,46 @@ should_interchange_loops (unsigned i_idx, unsigned o_idx,
   return false;
 }
 
+/* Return an upper bound in bytes of the memory touched by DATAREFS during
+   one execution of the loop whose index in the loop nest is I_IDX, or -1
+   if it is unknown.  Accesses to the same object are not merged, so this
+   overestimates the footprint of overlapping references.  */
+
+HOST_WIDE_INT
+tree_loop_interchange::max_data_footprint (unsigned i_idx,
+					   vec<data_reference_p> datarefs)
+{
+  widest_int footprint = 0;
+  struct data_reference *dr;
+
+  for (unsigned i = 0; datarefs.iterate (i, &dr); ++i)
+    {
+      tree access_size = TYPE_SIZE_UNIT (TREE_TYPE (DR_REF (dr)));
+      if (!access_size || TREE_CODE (access_size) != INTEGER_CST)
+	return -1;
+
+      widest_int extent = wi::to_widest (access_size);
+      vec<tree> *stride = DR_ACCESS_STRIDE (dr);
+      for (unsigned j = i_idx; j < stride->length (); ++j)
+	{
+	  tree step = (*stride)[j];
+	  if (TREE_CODE (step) != INTEGER_CST)
+	    return -1;
+	  if (integer_zerop (step))
+	    continue;
+	  HOST_WIDE_INT niter = max_loop_iterations_int (m_loop_nest[j]);
+	  if (niter < 0)
+	    return -1;
+	  extent += wi::abs (wi::to_widest (step)) * niter;
+	}
+      footprint += extent;
+    }
+
+  if (!wi::fits_shwi_p (footprint))
+    return -1;
+  return footprint.to_shwi ();
+}
+
 /* Try to interchange inner loop of a loop nest to outer level.  */
 
 bool
@@ -1645,11 +1686,29 @@ tree_loop_interchange::interchange (vec<data_reference_p> datarefs,
       if (stmt_cost < 0)
 	stmt_cost = 0;
 
+      /* Interchanging loops other than the innermost two only improves
+	 data locality.  Nothing is gained if the data touched by one
+	 execution of the inner loop of the pair already fits in the L1
+	 cache.  */
+      bool fits_l1_p = false;
+      if (iloop.m_loop->inner != NULL)
+	{
+	  HOST_WIDE_INT footprint = max_data_footprint (i_idx, datarefs);
+	  fits_l1_p = (footprint >= 0
+		       && footprint <= (HOST_WIDE_INT) param_l1_cache_size
+				       * 1024);
+	  if (fits_l1_p && dump_file && (dump_flags & TDF_DETAILS))
+	    fprintf (dump_file, "Data footprint of inner loop "
+		     HOST_WIDE_INT_PRINT_DEC " bytes fits in L1 cache\n",
+		     footprint);
+	}
+
       /* Check profitability for loop interchange.  */
-      if (should_interchange_loops (i_idx, o_idx, datarefs,
-				    (unsigned) iloop.m_num_stmts,
-				    (unsigned) stmt_cost,
-				    iloop.m_loop->inner == NULL))
+      if (!fits_l1_p
+	  && should_interchange_loops (i_idx, o_idx, datarefs,
+				       (unsigned) iloop.m_num_stmts,
+				       (unsigned) stmt_cost,
+				       iloop.m_loop->inner == NULL))
 	{
 	  if (dump_file && (dump_flags & TDF_DETAILS))
 	    fprintf (dump_file,
@@ -369,6 +369,7 @@ block_range_cache::block_range_cache ()
   m_ssa_ranges.create (0);
   m_ssa_ranges.safe_grow_cleared (num_ssa_names);
   m_range_allocator = new vrange_allocator;
+  m_num_caches = 0;
 }
 
 // Remove any m_block_caches which have been created.
@@ -394,6 +395,7 @@ block_range_cache::set_bb_range (tree name, const_basic_block bb,
 
   if (!m_ssa_ranges[v])
     {
+      m_num_caches++;
       // Use sparse bitmap representation if there are too many basic blocks.
       if (last_basic_block_for_fn (cfun) > param_vrp_sparse_threshold)
 	{
@@ -999,6 +1001,7 @@ ranger_cache::ranger_cache (int not_executable_flag, bool use_imm_uses)
 {
   m_workback = vNULL;
   m_temporal = new temporal_cache;
+  memset (&m_stats, 0, sizeof (m_stats));
 
   // If DOM info is available, spawn an oracle as well.
   create_relation_oracle ();
@@ -1023,6 +1026,14 @@ ranger_cache::ranger_cache (int not_executable_flag, bool use_imm_uses)
 
 ranger_cache::~ranger_cache ()
 {
+  statistics_counter_event (cfun, "ranger global cache lookups",
+			    m_stats.global_lookups);
+  statistics_counter_event (cfun, "ranger global cache current",
+			    m_stats.global_current);
+  statistics_counter_event (cfun, "ranger on-entry cache lookups",
+			    m_stats.entry_lookups);
+  statistics_counter_event (cfun, "ranger on-entry cache hits",
+			    m_stats.entry_hits);
   delete m_update;
   destroy_infer_oracle ();
   destroy_relation_oracle ();
@@ -1040,6 +1051,30 @@ ranger_cache::dump (FILE *f)
   fprintf (f, "=========================:\n");
   m_globals.dump (f);
   fprintf (f, "\n");
+  dump_stats (f);
+}
+
+// Dump the cache lookup statistics to file F.
+
+void
+ranger_cache::dump_stats (FILE *f)
+{
+  unsigned names = 0;
+  for (unsigned x = 1; x < num_ssa_names; x++)
+    if (gimple_range_ssa_p (ssa_name (x)))
+      names++;
+
+  fprintf (f, "Ranger cache statistics:\n");
+  fprintf (f, "  global lookups: %u, current: %u (%.1f%%)\n",
+	   m_stats.global_lookups, m_stats.global_current,
+	   m_stats.global_lookups
+	   ? m_stats.global_current * 100.0 / m_stats.global_lookups : 0.0);
+  fprintf (f, "  on-entry lookups: %u, hits: %u (%.1f%%)\n",
+	   m_stats.entry_lookups, m_stats.entry_hits,
+	   m_stats.entry_lookups
+	   ? m_stats.entry_hits * 100.0 / m_stats.entry_lookups : 0.0);
+  fprintf (f, "  on-entry caches: %u of %u names\n",
+	   m_on_entry.num_caches (), names);
 }
 
 // Dump the caches for basic block BB to file F.
@@ -1078,10 +1113,15 @@ ranger_cache::get_global_range (vrange &r, tree name, bool &current_p)
 
   // If there was a global value, set current flag, otherwise set a value.
   current_p = false;
+  m_stats.global_lookups++;
   if (had_global)
-    current_p = r.singleton_p ()
-		|| m_temporal->current_p (name, gori_ssa ()->depend1 (name),
-					  gori_ssa ()->depend2 (name));
+    {
+      current_p = r.singleton_p ()
+		  || m_temporal->current_p (name, gori_ssa ()->depend1 (name),
+					    gori_ssa ()->depend2 (name));
+      if (current_p)
+	m_stats.global_current++;
+    }
   else
     {
       // If no global value has been set and value is VARYING, fold the stmt
@@ -1472,8 +1512,12 @@ ranger_cache::fill_block_cache (tree name, basic_block bb, basic_block def_bb)
   unsigned start_length = m_workback.length ();
 
   // If the block cache is set, then we've already visited this block.
+  m_stats.entry_lookups++;
   if (m_on_entry.bb_range_p (name, bb))
-    return;
+    {
+      m_stats.entry_hits++;
+      return;
+    }
 
   if (DEBUG_RANGE_CACHE)
     {
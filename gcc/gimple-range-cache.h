@@ -41,8 +41,10 @@ public:
 
   void dump (FILE *f);
   void dump (FILE *f, basic_block bb, bool print_varying = true);
+  unsigned num_caches () const { return m_num_caches; }
 private:
   vec<class ssa_block_ranges *> m_ssa_ranges;
+  unsigned m_num_caches;
   ssa_block_ranges &get_block_ranges (tree name);
   ssa_block_ranges *query_block_ranges (tree name);
   class vrange_allocator *m_range_allocator;
@@ -120,6 +122,7 @@ public:
 
   void dump_bb (FILE *f, basic_block bb);
   virtual void dump (FILE *f) override;
+  void dump_stats (FILE *f);
 private:
   ssa_cache m_globals;
   block_range_cache m_on_entry;
@@ -142,6 +145,15 @@ private:
 
   vec<basic_block> m_workback;
   class update_list *m_update;
+
+  // Lookup statistics, reported by dump_stats.
+  struct
+  {
+    unsigned global_lookups;
+    unsigned global_current;
+    unsigned entry_lookups;
+    unsigned entry_hits;
+  } m_stats;
 };
 
 #endif // GCC_SSA_RANGE_CACHE_H
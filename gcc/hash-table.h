@@ -532,6 +532,19 @@ private:
   void verify (const compare_type &comparable, hashval_t hash);
   bool too_empty_p (unsigned int);
   void expand ();
+
+  /* Start loading the slot probed after the one at INDEX with step HASH2.
+     With double hashing successive probes land on unrelated cache lines,
+     so this overlaps the next miss with the comparison of the current
+     entry.  */
+  void prefetch_next_probe (hashval_t index, hashval_t hash2) const
+  {
+    index += hash2;
+    if (index >= m_size)
+      index -= m_size;
+    __builtin_prefetch (&m_entries[index]);
+  }
+
   static bool is_deleted (value_type &v)
   {
     /* Traits are supposed to avoid recognizing elements as both empty
@@ -1008,6 +1021,7 @@ hash_table<Descriptor, Lazy, Allocator>
         index -= size;
 
       entry = &m_entries[index];
+      prefetch_next_probe (index, hash2);
       if (is_empty (*entry)
           || (!is_deleted (*entry) && Descriptor::equal (*entry, comparable)))
 	return *entry;
@@ -1067,6 +1081,7 @@ hash_table<Descriptor, Lazy, Allocator>
 	index -= size;
 
       entry = &m_entries[index];
+      prefetch_next_probe (index, hash2);
       if (is_empty (*entry))
 	goto empty_entry;
       else if (is_deleted (*entry))
@@ -5652,11 +5652,14 @@ ira (FILE *f)
       num_used_regs++;
 
   /* If there are too many pseudos and/or basic blocks (e.g. 10K pseudos and
-     10K blocks or 100K pseudos and 1K blocks) or we have too many function
-     insns, we will use simplified and faster algorithms in LRA.  */
+     10K blocks or 100K pseudos and 1K blocks), too many pseudos on their own
+     or we have too many function insns, we will use simplified and faster
+     algorithms in LRA.  */
   lra_simple_p
     = (ira_use_lra_p
        && (num_used_regs >= (1U << 26) / last_basic_block_for_fn (cfun)
+	   || ((uint64_t) num_used_regs
+	       > (uint64_t) param_ira_simple_lra_pseudo_threshold * 1000)
            /* max uid is a good evaluation of the number of insns as most
               optimizations are done on tree-SSA level.  */
            || ((uint64_t) get_max_uid ()
@@ -585,10 +585,16 @@ bool
 late_combine::check_uses (set_info *def, rtx set)
 {
   use_info *prev_use = nullptr;
+  unsigned int num_uses = 0;
   for (use_info *use : def->nondebug_insn_uses ())
     {
       insn_info *use_insn = use->insn ();
 
+      // Each use is re-recognized during the combination attempt,
+      // so bound the work spent on definitions with very many uses.
+      if (++num_uses > (unsigned int) param_late_combine_max_uses)
+	return false;
+
       if (use->is_live_out_use ())
 	continue;
       if (use->only_occurs_in_notes ())
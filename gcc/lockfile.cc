@@ -27,13 +27,22 @@ along with GCC; see the file COPYING3.  If not see
 #define LOCKFILE_USE_FCNTL 1
 #endif
 
+/* Open the lockfile unless this object already has it open, so that
+   changing the kind of a held lock does not leak a descriptor.  */
+int
+lockfile::open_lockfile ()
+{
+  if (fd < 0)
+    fd = open (filename.c_str (), O_RDWR | O_CREAT, 0666);
+  return fd;
+}
+
 /* Unique write lock.  No other lock can be held on this lockfile.
    Blocking call.  */
 int
 lockfile::lock_write ()
 {
-  fd = open (filename.c_str (), O_RDWR | O_CREAT, 0666);
-  if (fd < 0)
+  if (open_lockfile () < 0)
     return -1;
 
 #ifdef LOCKFILE_USE_FCNTL
@@ -57,8 +66,8 @@ lockfile::lock_write ()
 int
 lockfile::try_lock_write ()
 {
-  fd = open (filename.c_str (), O_RDWR | O_CREAT, 0666);
-  if (fd < 0)
+  bool was_open = fd >= 0;
+  if (open_lockfile () < 0)
     return -1;
 
 #ifdef LOCKFILE_USE_FCNTL
@@ -72,8 +81,12 @@ lockfile::try_lock_write ()
 
   if (fcntl (fd, F_SETLK, &s_flock) == -1)
     {
-      close (fd);
-      fd = -1;
+      /* Keep a lock that was already held.  */
+      if (!was_open)
+	{
+	  close (fd);
+	  fd = -1;
+	}
       return 1;
     }
 #endif
@@ -87,8 +100,7 @@ lockfile::try_lock_write ()
 int
 lockfile::lock_read ()
 {
-  fd = open (filename.c_str (), O_RDWR | O_CREAT, 0666);
-  if (fd < 0)
+  if (open_lockfile () < 0)
     return -1;
 
 #ifdef LOCKFILE_USE_FCNTL
@@ -110,7 +122,7 @@ lockfile::lock_read ()
 void
 lockfile::unlock ()
 {
-  if (fd < 0)
+  if (fd >= 0)
     {
 #ifdef LOCKFILE_USE_FCNTL
       struct flock s_flock;
@@ -65,12 +65,15 @@ public:
   bool
   locked ()
   {
-    return fd < 0;
+    return fd >= 0;
   }
 
   /* Are lockfiles supported?  */
   static bool lockfile_supported ();
 private:
+  /* Opens the lockfile if needed.  Returns the file descriptor.  */
+  int open_lockfile ();
+
   std::string filename;
   int fd;
 };
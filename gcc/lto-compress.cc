@@ -106,6 +106,13 @@ lto_destroy_compression_stream (struct lto_compression_stream *stream)
 }
 
 #ifdef HAVE_ZSTD_H
+/* ZSTD compression and decompression contexts.  They are created on first
+   use and reused for every section; setting them up again for each of the
+   many small sections of an object file costs more than the actual work.  */
+
+static ZSTD_CCtx *lto_zstd_cctx;
+static ZSTD_DCtx *lto_zstd_dctx;
+
 /* Return a zstd compression level that zstd will not reject.  Normalizes
    the compression level from the command line flag, clamping non-default
    values to the appropriate end of their valid range.  */
@@ -135,8 +142,16 @@ lto_compression_zstd (struct lto_compression_stream *stream)
   size_t const outbuf_length = ZSTD_compressBound (size);
   char *outbuf = (char *) xmalloc (outbuf_length);
 
-  size_t const csize = ZSTD_compress (outbuf, outbuf_length, cursor, size,
-				      lto_normalized_zstd_level ());
+  if (!lto_zstd_cctx)
+    {
+      lto_zstd_cctx = ZSTD_createCCtx ();
+      if (!lto_zstd_cctx)
+	internal_error ("compressed stream: cannot create zstd context");
+    }
+
+  size_t const csize = ZSTD_compressCCtx (lto_zstd_cctx, outbuf, outbuf_length,
+					  cursor, size,
+					  lto_normalized_zstd_level ());
 
   if (ZSTD_isError (csize))
     internal_error ("compressed stream: %s", ZSTD_getErrorName (csize));
@@ -164,8 +179,16 @@ lto_uncompression_zstd (struct lto_compression_stream *stream)
   else if (rsize == ZSTD_CONTENTSIZE_UNKNOWN)
     internal_error ("original size unknown");
 
+  if (!lto_zstd_dctx)
+    {
+      lto_zstd_dctx = ZSTD_createDCtx ();
+      if (!lto_zstd_dctx)
+	internal_error ("decompressed stream: cannot create zstd context");
+    }
+
   char *outbuf = (char *) xmalloc (rsize);
-  size_t const dsize = ZSTD_decompress (outbuf, rsize, cursor, size);
+  size_t const dsize = ZSTD_decompressDCtx (lto_zstd_dctx, outbuf, rsize,
+					    cursor, size);
 
   if (ZSTD_isError (dsize))
     internal_error ("decompressed stream: %s", ZSTD_getErrorName (dsize));
@@ -54,6 +54,13 @@ file_checksum (char const *filename)
   return result;
 }
 
+/* Returns true if file exists.  */
+static int
+file_exists (char const *name)
+{
+  return access (name, R_OK) == 0;
+}
+
 /* Checks identity of two files.  */
 static bool
 files_identical (char const *first_filename, char const *second_filename)
@@ -143,7 +150,7 @@ ltrans_file_cache::item::item (std::string input, std::string output,
 			       checksum_t input_checksum,
 			       uint32_t last_used):
   input (std::move (input)), output (std::move (output)),
-  input_checksum (input_checksum), last_used (last_used)
+  input_checksum (input_checksum), last_used (last_used), producing (false)
 {
   lock = lockfile (this->input + ".lock");
 }
@@ -333,7 +340,8 @@ ltrans_file_cache::create_item (const checksum_t& checksum)
 
 /* Adds input file into cache.  Cache item with input file identical to
    added input file will be returned as _item.
-   If the file was already cached, `true` is returned, `false` otherwise.
+   If the file was already cached and its output exists or is being
+   produced by another process, `true` is returned, `false` otherwise.
    The added input file is deleted (or moved).
 
    Must be called with creation_lock held to prevent data race.  */
@@ -350,6 +358,19 @@ ltrans_file_cache::add_to_cache (const char* filename, item*& _item)
       unlink (filename);
       _item = it->second;
       _item->last_used = usage_counter++;
+
+      /* An identical partition of this link is already being compiled
+	 into the output.  fcntl locks are per process, so the lock below
+	 would not tell.  */
+      if (_item->producing)
+	return true;
+
+      /* The output is missing if the LTRANS job that was to produce it
+	 failed or was interrupted.  Unless another process is producing it
+	 right now, treat this as a miss so that it is compiled again.  */
+      if (!file_exists (_item->output.c_str ())
+	  && _item->lock.try_lock_write () == 0)
+	return false;
       return true;
     }
   else
@@ -385,13 +406,6 @@ ltrans_file_cache::try_prune ()
     }
 }
 
-/* Returns true if file exists.  */
-static int
-file_exists (char const *name)
-{
-  return access (name, R_OK) == 0;
-}
-
 /* Prunes oldest unused cache items over limit.
    Must be called with deletion_lock held to prevent data race.  */
 void
@@ -46,6 +46,9 @@ public:
 
     /* Lockfile so that output file can be created later than input file.  */
     lockfile lock;
+
+    /* True if this process holds LOCK to produce the output file.  */
+    bool producing;
   };
 
   /* Constructor.  Resulting cache item filenames will be
@@ -70,7 +73,8 @@ public:
 
   /* Adds input file into cache.  Cache item with input file identical to
      added input file will be returned as _item.
-     If the file was already cached, `true` is returned, `false` otherwise.
+     If the file was already cached and its output exists or is being
+     produced by another process, `true` is returned, `false` otherwise.
      The added input file is deleted (or moved).
 
      Must be called with creation_lock held to prevent data race.  */
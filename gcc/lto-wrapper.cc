@@ -2034,16 +2034,6 @@ cont:
 	    }
 	}
 
-      if (parallel)
-	{
-	  if (save_temps)
-	    makefile = concat (dumppfx, "ltrans.mk", NULL);
-	  else
-	    makefile = make_temp_file (".mk");
-	  mstream = fopen (makefile, "w");
-	  qsort (ltrans_priorities, nr, sizeof (int) * 2, cmp_priority);
-	}
-
       ltrans_file_cache ltrans_cache (ltrans_cache_dir, "ltrans", ".o",
 				      ltrans_cache_size);
 
@@ -2082,6 +2072,7 @@ cont:
 		  /* Lock so no other process can access until the file is
 		     compiled.  */
 		  item->lock.lock_write ();
+		  item->producing = true;
 		  recompiling++;
 		}
 	    }
@@ -2092,6 +2083,30 @@ cont:
 	  ltrans_cache.creation_lock.unlock ();
 	}
 
+      /* Going through make only pays off if more than one LTRANS job is
+	 left, for example not when there is a single partition or when all
+	 but one partition were found in the incremental cache.  Run a lone
+	 job directly instead.  */
+      if (parallel)
+	{
+	  int jobs = 0;
+	  for (i = 0; i < nr; ++i)
+	    if (!output_names[i])
+	      jobs++;
+	  if (jobs <= 1)
+	    parallel = 0;
+	}
+
+      if (parallel)
+	{
+	  if (save_temps)
+	    makefile = concat (dumppfx, "ltrans.mk", NULL);
+	  else
+	    makefile = make_temp_file (".mk");
+	  mstream = fopen (makefile, "w");
+	  qsort (ltrans_priorities, nr, sizeof (int) * 2, cmp_priority);
+	}
+
       /* Execute the LTRANS stage for each input file (or prepare a
 	 makefile to invoke this in parallel).  */
       for (i = 0; i < nr; ++i)
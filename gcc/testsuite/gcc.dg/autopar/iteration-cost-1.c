@@ -0,0 +1,20 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -ftree-parallelize-loops=4 --param parloops-iteration-cost=1 -fdump-tree-parloops2-details" } */
+
+#define N 200
+
+int a[N], b[N], c[N];
+
+void
+foo (void)
+{
+  int i;
+
+  /* With only 200 iterations this loop is normally too short to be
+     worth parallelizing, but each iteration is now considered costly
+     enough to amortize starting the threads.  */
+  for (i = 0; i < N; i++)
+    a[i] = b[i] + c[i];
+}
+
+/* { dg-final { scan-tree-dump-times "SUCCESS: may be parallelized" 1 "parloops2" } } */
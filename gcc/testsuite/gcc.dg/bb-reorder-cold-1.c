@@ -0,0 +1,24 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -freorder-blocks-algorithm=stc -fno-reorder-blocks-and-partition -fdump-rtl-bbro-details" } */
+
+/* The error path is probably never executed, so its trace must not be
+   chained after the hot loop trace.  */
+
+extern void report_error (int) __attribute__ ((cold));
+extern int work (int);
+
+int
+foo (int x)
+{
+  for (;;)
+    {
+      x = work (x);
+      if (x < 0)
+	{
+	  report_error (x);
+	  return -1;
+	}
+    }
+}
+
+/* { dg-final { scan-rtl-dump "Not connecting \[0-9\]+ \[0-9\]+: only one side is probably never executed" "bbro" } } */
@@ -0,0 +1,24 @@
+/* { dg-do compile } */
+/* { dg-options "-Os -freorder-blocks-algorithm=stc -fno-reorder-blocks-and-partition -fdump-rtl-bbro-details" } */
+
+/* When optimizing for size, the probably never executed error path is
+   still connected to the loop trace.  */
+
+extern void report_error (int) __attribute__ ((cold));
+extern int work (int);
+
+int
+foo (int x)
+{
+  for (;;)
+    {
+      x = work (x);
+      if (x < 0)
+	{
+	  report_error (x);
+	  return -1;
+	}
+    }
+}
+
+/* { dg-final { scan-rtl-dump-not "Not connecting" "bbro" } } */
@@ -0,0 +1,17 @@
+/* { dg-do compile } */
+/* { dg-options "-O3 -fdump-tree-ifcvt-details" } */
+
+/* The conditional load from TBL cannot trap since its index is an
+   unsigned char, so the loop can be if-converted without masked loads.  */
+
+int tbl[256];
+
+void
+foo (int *restrict out, unsigned char *restrict in, int *restrict cond,
+     int n)
+{
+  for (int i = 0; i < n; i++)
+    out[i] = cond[i] ? tbl[in[i]] : 0;
+}
+
+/* { dg-final { scan-tree-dump "Applying if-conversion" "ifcvt" } } */
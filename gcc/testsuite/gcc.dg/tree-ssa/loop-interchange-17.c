@@ -0,0 +1,20 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -floop-interchange -fdump-tree-linterchange-details --param l1-cache-size=64" } */
+
+/* The data touched by one execution of the j loop fits in the L1 cache,
+   so there is no point in interchanging it with the i loop.  */
+
+#define M 8
+int a[M][M], b[M][M], c[M][M];
+
+void
+matrix_mul (int n)
+{
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      for (int k = 0; k < n; k++)
+	c[i][j] = c[i][j] + a[i][k] * b[k][j];
+}
+
+/* { dg-final { scan-tree-dump "fits in L1 cache\nLoop_pair<outer:\[0-9\]+, inner:\[0-9\]+> is not interchanged" "linterchange" } } */
+/* { dg-final { scan-tree-dump-not "Loop_pair<outer:1, inner:2> is interchanged" "linterchange" } } */
@@ -0,0 +1,12 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 --param rpo-vn-max-loop-size=1 -fdump-tree-fre1-details" } */
+
+int foo (int n)
+{
+  int x = 1;
+  for (int i = 0; i < n; ++i)
+    x = 2 - x;
+  return x;
+}
+
+/* { dg-final { scan-tree-dump "not iterating loop 1" "fre1" } } */
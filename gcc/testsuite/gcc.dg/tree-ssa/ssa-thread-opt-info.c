@@ -0,0 +1,18 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -fopt-info-thread-all" } */
+
+void bar (void);
+void baz (void);
+
+void
+foo (int a)
+{
+  int x;
+  if (a)
+    x = 1;
+  else
+    x = 0;
+  bar ();
+  if (x) /* { dg-message "optimized: threaded path of \[0-9\]+ blocks to bb \[0-9\]+" } */
+    baz ();
+}
@@ -0,0 +1,15 @@
+/* { dg-do compile } */
+/* { dg-require-effective-target vect_int } */
+
+void __attribute__((noipa))
+foo (int *__restrict p, int *__restrict q)
+{
+  p[0] = q[0] + 1;
+  p[1] = q[1] + 2;
+  p[2] = q[2] + 3;
+  p[3] = q[3] + 4;
+}
+
+/* The region note should be reported at the first statement of the
+   region, not at its last.  */
+/* { dg-final { scan-tree-dump "bb-slp-78.c:7:\[0-9\]+: note: analyzing region of 1 basic blocks starting at bb2" "slp2" } } */
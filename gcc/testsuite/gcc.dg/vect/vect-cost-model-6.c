@@ -0,0 +1,11 @@
+/* { dg-do compile } */
+/* { dg-additional-options "-O2 -ftree-vectorize -fvect-cost-model=dynamic" } */
+
+void
+f (int *restrict x, int *restrict y)
+{
+  for (unsigned int i = 0; i < 1023; ++i)
+    x[i] += y[i];
+}
+
+/* { dg-final { scan-tree-dump {Costs for vector mode [^\n]*: VF [0-9]+, scalar iteration [0-9]+, vector body [0-9]+} vect { target { vect_int && vect_hw_misalign } } } } */
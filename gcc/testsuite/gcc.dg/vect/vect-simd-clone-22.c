@@ -0,0 +1,49 @@
+/* { dg-require-effective-target vect_simd_clones } */
+/* { dg-additional-options "-fopenmp-simd" } */
+/* { dg-additional-options "-mavx" { target avx_runtime } } */
+
+/* The simd clones of a local function only become needed once the
+   vectorizer of the caller picks them; they must still be emitted.  */
+
+#include "tree-vect.h"
+
+#ifndef N
+#define N 1024
+#endif
+
+int a[N], b[N];
+
+#pragma omp declare simd notinbranch
+__attribute__((noinline)) static int
+foo (int x, int y)
+{
+  return x * 3 + y;
+}
+
+__attribute__((noinline)) void
+bar (void)
+{
+  int i;
+  #pragma omp simd
+  for (i = 0; i < N; i++)
+    a[i] = foo (a[i], b[i]);
+}
+
+int
+main ()
+{
+  int i;
+  check_vect ();
+#pragma GCC novector
+  for (i = 0; i < N; i++)
+    {
+      a[i] = i;
+      b[i] = i & 7;
+    }
+  bar ();
+#pragma GCC novector
+  for (i = 0; i < N; i++)
+    if (a[i] != i * 3 + (i & 7))
+      abort ();
+  return 0;
+}
@@ -772,6 +772,41 @@ hash_memrefs_baserefs_and_store_DRs_read_written_info (data_reference_p a)
     }
 }
 
+/* Return TRUE if the type of index IDX of an array reference REF, looking
+   through a value-preserving widening conversion, cannot represent values
+   outside of the array bounds.  Unlike a proof based on the evolution of
+   IDX this holds for any value IDX is computed from, which makes it valid
+   for speculatively executed accesses as well.  */
+
+static bool
+idx_type_within_array_bound (tree ref, tree idx)
+{
+  tree type = TREE_TYPE (idx);
+  if (TREE_CODE (idx) == SSA_NAME)
+    if (gassign *def = dyn_cast <gassign *> (SSA_NAME_DEF_STMT (idx)))
+      if (CONVERT_EXPR_CODE_P (gimple_assign_rhs_code (def)))
+	{
+	  tree inner_type = TREE_TYPE (gimple_assign_rhs1 (def));
+	  if (INTEGRAL_TYPE_P (inner_type)
+	      && TYPE_PRECISION (inner_type) < TYPE_PRECISION (type)
+	      && (TYPE_UNSIGNED (inner_type) || !TYPE_UNSIGNED (type)))
+	    type = inner_type;
+	}
+  if (!INTEGRAL_TYPE_P (type))
+    return false;
+
+  tree low = array_ref_low_bound (ref);
+  tree high = array_ref_up_bound (ref);
+  if (TREE_CODE (low) != INTEGER_CST
+      || !high || TREE_CODE (high) != INTEGER_CST)
+    return false;
+
+  signop sgn = TYPE_SIGN (type);
+  return (widest_int::from (wi::min_value (type), sgn) >= wi::to_widest (low)
+	  && widest_int::from (wi::max_value (type), sgn)
+	     <= wi::to_widest (high));
+}
+
 /* Return TRUE if can prove the index IDX of an array reference REF is
    within array bound.  Return false otherwise.  */
 
@@ -800,7 +835,7 @@ idx_within_array_bound (tree ref, tree *idx, void *dta)
 
   if (!init || TREE_CODE (init) != INTEGER_CST
       || (step && TREE_CODE (step) != INTEGER_CST))
-    return false;
+    return idx_type_within_array_bound (ref, *idx);
 
   low = array_ref_low_bound (ref);
   high = array_ref_up_bound (ref);
@@ -43,6 +43,7 @@ along with GCC; see the file COPYING3.  If not see
 #include "tree-ssa-loop-niter.h"
 #include "tree-ssa-loop.h"
 #include "tree-into-ssa.h"
+#include "tree-inline.h"
 #include "cfgloop.h"
 #include "tree-scalar-evolution.h"
 #include "langhooks.h"
@@ -890,6 +891,26 @@ parloops_force_simple_reduction (loop_vec_info loop_info, stmt_vec_info phi_info
    thread.  */
 #define MIN_PER_THREAD param_parloops_min_per_thread
 
+/* Return the minimal number of iterations of LOOP that should be executed
+   in each thread.  Expensive iterations amortize the cost of starting the
+   threads sooner, so for an innermost loop MIN_PER_THREAD is scaled down
+   by the estimated time of one iteration relative to
+   --param parloops-iteration-cost.  */
+
+static unsigned
+min_iterations_per_thread (class loop *loop)
+{
+  if (loop->inner)
+    return 2;
+
+  unsigned iter_cost = tree_num_loop_insns (loop, &eni_time_weights);
+  unsigned ref_cost = param_parloops_iteration_cost;
+  if (iter_cost <= ref_cost)
+    return MIN_PER_THREAD;
+  return MAX (2, (unsigned HOST_WIDE_INT) MIN_PER_THREAD * ref_cost
+		 / iter_cost);
+}
+
 /* Element of the hashtable, representing a
    reduction in the current loop.  */
 struct reduction_info
@@ -2974,13 +2995,15 @@ num_phis (basic_block bb, bool count_virtual_p)
    later.
 
    NITER describes number of iterations of LOOP.
-   REDUCTION_LIST describes the reductions existent in the LOOP.  */
+   REDUCTION_LIST describes the reductions existent in the LOOP.
+   Unless OACC_KERNELS_P, the parallel version is only executed if
+   each thread gets at least M_P_THREAD iterations.  */
 
 static void
 gen_parallel_loop (class loop *loop,
 		   reduction_info_table_type *reduction_list,
 		   unsigned n_threads, class tree_niter_desc *niter,
-		   bool oacc_kernels_p)
+		   bool oacc_kernels_p, unsigned m_p_thread)
 {
   tree many_iterations_cond, type, nit;
   tree arg_struct, new_arg_struct;
@@ -2989,7 +3012,6 @@ gen_parallel_loop (class loop *loop,
   struct clsn_data clsn_data;
   location_t loc;
   gimple *cond_stmt;
-  unsigned int m_p_thread=2;
 
   /* From
 
@@ -3010,7 +3032,7 @@ gen_parallel_loop (class loop *loop,
      ---------------------------------------------------------------------
 
      if (MAY_BE_ZERO
-     || NITER < MIN_PER_THREAD * N_THREADS)
+     || NITER < M_P_THREAD * N_THREADS)
      goto original;
 
      BODY1;
@@ -3062,11 +3084,6 @@ gen_parallel_loop (class loop *loop,
 
   if (!oacc_kernels_p)
     {
-      if (loop->inner)
-	m_p_thread=2;
-      else
-	m_p_thread=MIN_PER_THREAD;
-
       gcc_checking_assert (n_threads != 0);
       many_iterations_cond =
 	fold_build2 (GE_EXPR, boolean_type_node,
@@ -4100,14 +4117,14 @@ parallelize_loops (bool oacc_kernels_p)
       estimated = estimated_loop_iterations_int (loop);
       if (estimated == -1)
 	estimated = get_likely_max_loop_iterations_int (loop);
+      unsigned min_per_thread = min_iterations_per_thread (loop);
       /* FIXME: Bypass this check as graphite doesn't update the
 	 count and frequency correctly now.  */
       if (!flag_loop_parallelize_all
 	  && !oacc_kernels_p
 	  && ((estimated != -1
 	       && (estimated
-		   < ((HOST_WIDE_INT) n_threads
-		      * (loop->inner ? 2 : MIN_PER_THREAD) - 1)))
+		   < ((HOST_WIDE_INT) n_threads * min_per_thread - 1)))
 	      /* Do not bother with loops in cold areas.  */
 	      || optimize_loop_nest_for_size_p (loop)))
 	continue;
@@ -4148,7 +4165,8 @@ parallelize_loops (bool oacc_kernels_p)
 	}
 
       gen_parallel_loop (loop, &reduction_list,
-			 n_threads, &niter_desc, oacc_kernels_p);
+			 n_threads, &niter_desc, oacc_kernels_p,
+			 min_per_thread);
     }
 
   obstack_free (&parloop_obstack, NULL);
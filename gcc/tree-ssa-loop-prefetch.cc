@@ -48,6 +48,7 @@ along with GCC; see the file COPYING3.  If not see
 #include "tree-data-ref.h"
 #include "diagnostic-core.h"
 #include "dbgcnt.h"
+#include "sreal.h"
 
 /* This pass inserts prefetch instructions to optimize cache usage during
    accesses to arrays in loops.  It processes loops sequentially and:
@@ -1881,6 +1882,39 @@ insn_to_prefetch_ratio_too_small_p (unsigned ninsns, unsigned prefetch_count,
 }
 
 
+/* Return the estimated time of one iteration of LOOP.  The time of each
+   block is weighted by its execution count relative to the loop header,
+   so that rarely executed paths do not inflate the estimate and inner
+   loops are accounted for by their trip counts.  */
+
+static unsigned
+estimate_loop_iteration_time (class loop *loop)
+{
+  basic_block *body = get_loop_body (loop);
+  profile_count header_count = loop->header->count;
+  bool weighted = header_count.nonzero_p ();
+  sreal time = 0;
+
+  for (unsigned i = 0; i < loop->num_nodes; i++)
+    {
+      basic_block bb = body[i];
+      unsigned bb_time = 0;
+      for (gimple_stmt_iterator gsi = gsi_start_bb (bb); !gsi_end_p (gsi);
+	   gsi_next (&gsi))
+	bb_time += estimate_num_insns (gsi_stmt (gsi), &eni_time_weights);
+
+      if (weighted && bb->count.initialized_p ())
+	time += bb->count.to_sreal_scale (header_count) * bb_time;
+      else
+	time += bb_time;
+    }
+  free (body);
+
+  if (time == 0)
+    return 0;
+  return MAX (1, MIN (time.to_nearest_int (), INT_MAX));
+}
+
 /* Issue prefetch instructions for array references in LOOP.  Returns
    true if the LOOP was unrolled and updates NEED_LC_SSA_UPDATE if we need
    to update SSA for virtual operands and LC SSA for a split edge.  */
@@ -1903,9 +1937,7 @@ loop_prefetch_arrays (class loop *loop, bool &need_lc_ssa_update)
       return false;
     }
 
-  /* FIXME: the time should be weighted by the probabilities of the blocks in
-     the loop body.  */
-  time = tree_num_loop_insns (loop, &eni_time_weights);
+  time = estimate_loop_iteration_time (loop);
   if (time == 0)
     return false;
 
@@ -8605,39 +8605,56 @@ do_rpo_vn_1 (function *fn, edge entry, bitmap exit_bbs,
   entry->dest->flags |= BB_EXECUTABLE;
 
   /* As heuristic to improve compile-time we handle only the N innermost
-     loops and the outermost one optimistically.  */
+     loops and the outermost one optimistically.  Likewise for loops with
+     more than M blocks, since each iteration re-visits all of them.  */
   if (iterate)
     {
+      auto no_iterate_loop = [&] (class loop *loop)
+	{
+	  basic_block header = loop->header;
+	  bool non_latch_backedge = false;
+	  edge e;
+	  edge_iterator ei;
+	  FOR_EACH_EDGE (e, ei, header->preds)
+	    if (e->flags & EDGE_DFS_BACK)
+	      {
+		/* There can be a non-latch backedge into the header
+		   which is part of an outer irreducible region.  We
+		   cannot avoid iterating this block then.  */
+		if (!dominated_by_p (CDI_DOMINATORS,
+				     e->src, e->dest))
+		  {
+		    if (dump_file && (dump_flags & TDF_DETAILS))
+		      fprintf (dump_file, "non-latch backedge %d -> %d "
+			       "forces iteration of loop %d\n",
+			       e->src->index, e->dest->index, loop->num);
+		    non_latch_backedge = true;
+		  }
+		else
+		  e->flags |= EDGE_EXECUTABLE;
+	      }
+	  rpo_state[bb_to_rpo[header->index]].iterate = non_latch_backedge;
+	};
+
       unsigned max_depth = param_rpo_vn_max_loop_depth;
       for (auto loop : loops_list (cfun, LI_ONLY_INNERMOST))
 	if (loop_depth (loop) > max_depth)
 	  for (unsigned i = 2;
 	       i < loop_depth (loop) - max_depth; ++i)
-	    {
-	      basic_block header = superloop_at_depth (loop, i)->header;
-	      bool non_latch_backedge = false;
-	      edge e;
-	      edge_iterator ei;
-	      FOR_EACH_EDGE (e, ei, header->preds)
-		if (e->flags & EDGE_DFS_BACK)
-		  {
-		    /* There can be a non-latch backedge into the header
-		       which is part of an outer irreducible region.  We
-		       cannot avoid iterating this block then.  */
-		    if (!dominated_by_p (CDI_DOMINATORS,
-					 e->src, e->dest))
-		      {
-			if (dump_file && (dump_flags & TDF_DETAILS))
-			  fprintf (dump_file, "non-latch backedge %d -> %d "
-				   "forces iteration of loop %d\n",
-				   e->src->index, e->dest->index, loop->num);
-			non_latch_backedge = true;
-		      }
-		    else
-		      e->flags |= EDGE_EXECUTABLE;
-		  }
-	      rpo_state[bb_to_rpo[header->index]].iterate = non_latch_backedge;
-	    }
+	    no_iterate_loop (superloop_at_depth (loop, i));
+
+      if (!do_region)
+	{
+	  unsigned max_size = param_rpo_vn_max_loop_size;
+	  for (auto loop : loops_list (cfun, 0))
+	    if (loop->num_nodes > max_size)
+	      {
+		if (dump_file && (dump_flags & TDF_DETAILS))
+		  fprintf (dump_file, "not iterating loop %d with %u blocks\n",
+			   loop->num, loop->num_nodes);
+		no_iterate_loop (loop);
+	      }
+	}
     }
 
   uint64_t nblk = 0;
@@ -909,47 +909,65 @@ constraint_equal (const constraint &a, const constraint &b)
 }
 
 
-/* Find a constraint LOOKFOR in the sorted constraint vector VEC */
+/* qsort comparison function for constraints, ordering them like
+   constraint_less.  */
 
-static constraint_t
-constraint_vec_find (vec<constraint_t> vec,
-		     constraint &lookfor)
+static int
+constraint_cmp (const void *pa, const void *pb)
 {
-  unsigned int place;
-  constraint_t found;
-
-  if (!vec.exists ())
-    return NULL;
-
-  place = vec.lower_bound (&lookfor, constraint_less);
-  if (place >= vec.length ())
-    return NULL;
-  found = vec[place];
-  if (!constraint_equal (*found, lookfor))
-    return NULL;
-  return found;
+  const constraint_t a = *(const constraint_t *) pa;
+  const constraint_t b = *(const constraint_t *) pb;
+  if (constraint_less (a, b))
+    return -1;
+  if (constraint_less (b, a))
+    return 1;
+  return 0;
 }
 
 /* Union two constraint vectors, TO and FROM.  Put the result in TO.
-   Returns true of TO set is changed.  */
+   Returns true of TO set is changed.  TO has to be sorted; FROM is
+   sorted here since renaming its constraints may have broken its order.
+   The union is then computed by a single merge rather than by inserting
+   each constraint of FROM into TO, which is quadratic when large
+   complex constraint sets are repeatedly unified.  */
 
 static bool
 constraint_set_union (vec<constraint_t> *to,
 		      vec<constraint_t> *from)
 {
-  int i;
-  constraint_t c;
-  bool any_change = false;
+  if (from->is_empty ())
+    return false;
 
-  FOR_EACH_VEC_ELT (*from, i, c)
-    {
-      if (constraint_vec_find (*to, *c) == NULL)
+  from->qsort (constraint_cmp);
+
+  vec<constraint_t> merged;
+  merged.create (to->length () + from->length ());
+  bool any_change = false;
+  unsigned i = 0, j = 0;
+  while (i < to->length () || j < from->length ())
+    {
+      constraint_t c;
+      bool from_from = false;
+      if (j == from->length ()
+	  || (i < to->length () && !constraint_less ((*from)[j], (*to)[i])))
+	c = (*to)[i++];
+      else
 	{
-	  unsigned int place = to->lower_bound (c, constraint_less);
-	  to->safe_insert (place, c);
-          any_change = true;
+	  c = (*from)[j++];
+	  from_from = true;
 	}
+
+      /* Equal constraints are adjacent now, keep only the first, which is
+	 the one from TO if there is any.  */
+      if (!merged.is_empty () && constraint_equal (*merged.last (), *c))
+	continue;
+
+      any_change |= from_from;
+      merged.quick_push (c);
     }
+
+  to->release ();
+  *to = merged;
   return any_change;
 }
 
@@ -253,6 +253,10 @@ back_threader::maybe_register_path (back_threader_profitability &profit)
 	{
 	  if (irreducible)
 	    vect_free_loop_info_assumptions (m_path[0]->loop_father);
+	  if (dump_enabled_p ())
+	    dump_printf_loc (MSG_OPTIMIZED_LOCATIONS, m_last_stmt,
+			     "threaded path of %u blocks to bb %d\n",
+			     m_path.length (), taken_edge->dest->index);
 	}
       else
 	taken_edge = NULL;
@@ -940,7 +944,7 @@ const pass_data pass_data_early_thread_jumps =
 {
   GIMPLE_PASS,
   "ethread",
-  OPTGROUP_NONE,
+  OPTGROUP_THREAD,
   TV_TREE_SSA_THREAD_JUMPS,
   ( PROP_cfg | PROP_ssa ),
   0,
@@ -953,7 +957,7 @@ const pass_data pass_data_thread_jumps =
 {
   GIMPLE_PASS,
   "thread",
-  OPTGROUP_NONE,
+  OPTGROUP_THREAD,
   TV_TREE_SSA_THREAD_JUMPS,
   ( PROP_cfg | PROP_ssa ),
   0,
@@ -966,7 +970,7 @@ const pass_data pass_data_thread_jumps_full =
 {
   GIMPLE_PASS,
   "threadfull",
-  OPTGROUP_NONE,
+  OPTGROUP_THREAD,
   TV_TREE_SSA_THREAD_JUMPS,
   ( PROP_cfg | PROP_ssa ),
   0,
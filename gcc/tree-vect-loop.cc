@@ -3405,6 +3405,32 @@ again:
   goto start_over;
 }
 
+/* Dump a one-line summary of the costs computed for LOOP_VINFO, so that
+   the costs of each candidate vector mode and of the mode finally chosen
+   appear as a single optimization record.  */
+
+static void
+vect_dump_loop_vinfo_costs (loop_vec_info loop_vinfo)
+{
+  if (!dump_enabled_p ())
+    return;
+
+  const vector_costs *costs = loop_vinfo->vector_costs;
+  const vector_costs *scalar_costs = loop_vinfo->scalar_costs;
+  if (!costs || !costs->finished_p ()
+      || !scalar_costs || !scalar_costs->finished_p ())
+    return;
+
+  dump_printf_loc (MSG_NOTE, vect_location,
+		   "***** Costs for vector mode %s: VF ",
+		   GET_MODE_NAME (loop_vinfo->vector_mode));
+  dump_dec (MSG_NOTE, LOOP_VINFO_VECT_FACTOR (loop_vinfo));
+  dump_printf (MSG_NOTE, ", scalar iteration %u, vector body %u,"
+	       " vector prologue %u, vector epilogue %u\n",
+	       scalar_costs->total_cost (), costs->body_cost (),
+	       costs->prologue_cost (), costs->epilogue_cost ());
+}
+
 /* Return true if vectorizing a loop using NEW_LOOP_VINFO appears
    to be better than vectorizing it using OLD_LOOP_VINFO.  Assume that
    OLD_LOOP_VINFO is better unless something specifically indicates
@@ -3511,6 +3537,9 @@ vect_analyze_loop_1 (class loop *loop, vec_info_shared *shared,
 	delete unroll_vinfo;
     }
 
+  if (res)
+    vect_dump_loop_vinfo_costs (loop_vinfo);
+
   /* Remember the autodetected vector mode.  */
   if (vector_mode == VOIDmode)
     autodetected_vector_mode = loop_vinfo->vector_mode;
@@ -9728,6 +9728,7 @@ vect_slp_bbs (const vec<basic_block> &bbs, loop_p orig_loop)
   auto_vec<int> dataref_groups;
   int insns = 0;
   int current_group = 0;
+  dump_user_location_t first_loc;
 
   for (unsigned i = 0; i < bbs.length (); i++)
     {
@@ -9742,7 +9743,11 @@ vect_slp_bbs (const vec<basic_block> &bbs, loop_p orig_loop)
 	  insns++;
 
 	  if (gimple_location (stmt) != UNKNOWN_LOCATION)
-	    vect_location = stmt;
+	    {
+	      vect_location = stmt;
+	      if (first_loc.get_location_t () == UNKNOWN_LOCATION)
+		first_loc = stmt;
+	    }
 
 	  if (!vect_find_stmt_data_reference (NULL, stmt, &datarefs,
 					      &dataref_groups, current_group))
@@ -9752,6 +9757,12 @@ vect_slp_bbs (const vec<basic_block> &bbs, loop_p orig_loop)
       ++current_group;
     }
 
+  if (dump_enabled_p ())
+    dump_printf_loc (MSG_NOTE, first_loc,
+		     "analyzing region of %u basic blocks starting at bb%d "
+		     "with %d statements\n",
+		     bbs.length (), bbs[0]->index, insns);
+
   return vect_slp_region (bbs, datarefs, &dataref_groups, insns, orig_loop);
 }
 
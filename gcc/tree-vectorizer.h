@@ -1680,6 +1680,7 @@ public:
   unsigned int total_cost () const;
   unsigned int suggested_unroll_factor () const;
   machine_mode suggested_epilogue_mode () const;
+  bool finished_p () const { return m_finished; }
 
 protected:
   unsigned int record_stmt_cost (stmt_vec_info, vect_cost_model_location,
@@ -7053,6 +7053,18 @@ compute_bb_dataflow (basic_block bb)
   return changed;
 }
 
+/* Return the number of hash table slots used by the IN and OUT sets of
+   BB, counting a table shared between the two only once.  */
+
+static int
+dataflow_sets_htab_size (basic_block bb)
+{
+  variable_table_type *in = shared_hash_htab (VTI (bb)->in.vars);
+  variable_table_type *out = shared_hash_htab (VTI (bb)->out.vars);
+
+  return in->size () + (out != in ? out->size () : 0);
+}
+
 /* Find the locations of variables in the whole function.  */
 
 static bool
@@ -7127,8 +7139,7 @@ vt_find_locations (void)
 
 	      if (VTI (bb)->in.vars)
 		{
-		  htabsz -= (shared_hash_htab (VTI (bb)->in.vars)->size ()
-			     + shared_hash_htab (VTI (bb)->out.vars)->size ());
+		  htabsz -= dataflow_sets_htab_size (bb);
 		  oldinsz = shared_hash_htab (VTI (bb)->in.vars)->elements ();
 		  oldoutsz = shared_hash_htab (VTI (bb)->out.vars)->elements ();
 		}
@@ -7192,8 +7203,7 @@ vt_find_locations (void)
 
 	      changed = compute_bb_dataflow (bb);
 	      n_blocks_processed++;
-	      htabsz += (shared_hash_htab (VTI (bb)->in.vars)->size ()
-			 + shared_hash_htab (VTI (bb)->out.vars)->size ());
+	      htabsz += dataflow_sets_htab_size (bb);
 
 	      if (htabmax && htabsz > htabmax)
 		{